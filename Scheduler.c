@@ -2,7 +2,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#ifndef MAX_PROCESSES
 #define MAX_PROCESSES 10
+#endif
 
 typedef enum { NEW, READY, RUNNING, FINISHED } State;
 
@@ -36,39 +38,15 @@ Process* dequeue() {
     return p;
 }
 
-Process* select_highest_priority(float alpha, int current_time) {
-    Process* prev = NULL, *curr = ready_queue, *max_prev = NULL, *max = NULL;
-    int max_effective_priority = -1;
-
-    while (curr) {
-        int waiting_time = current_time - curr->arrival_time;
-        int effective_priority = curr->priority + (int)(alpha * waiting_time);
-
-        if (!max || effective_priority > max_effective_priority) {
-            max = curr;
-            max_prev = prev;
-            max_effective_priority = effective_priority;
-        }
-        prev = curr;
-        curr = curr->next;
-    }
-
-    if (max) {
-        if (max_prev) max_prev->next = max->next;
-        else ready_queue = max->next;
-        max->next = NULL;
-    }
-    return max;
-}
-
-void load_processes_from_file(const char* filename, Process jobQueue[]) {
+/* Reads at most MAX_PROCESSES lines and returns how many were read. */
+int load_processes_from_file(const char* filename, Process jobQueue[]) {
     FILE* file = fopen(filename, "r");
     if (!file) {
         perror("파일 열기 실패");
         exit(1);
     }
     int i = 0;
-    while (fscanf(file, "%d %d %d %d",
+    while (i < MAX_PROCESSES && fscanf(file, "%d %d %d %d",
         &jobQueue[i].pid,
         &jobQueue[i].priority,
         &jobQueue[i].arrival_time,
@@ -82,6 +60,7 @@ void load_processes_from_file(const char* filename, Process jobQueue[]) {
         i++;
     }
     fclose(file);
+    return i;
 }
 
 void calculate_and_print_stats(Process jobQueue[], FILE* out, int total_time) {
@@ -100,49 +79,74 @@ void calculate_and_print_stats(Process jobQueue[], FILE* out, int total_time) {
     fprintf(out, "Average turnaround time : %.1f\n", total_turn / MAX_PROCESSES);
 }
 
-void run_fcfs(Process jobQueue[], const char* outfile) {
+
+typedef struct {
+    int quantum;
+    float alpha;
+} KernelParams;
+
+typedef int (*SimKernel)(Process jobQueue[], FILE* out, const KernelParams* params);
+
+/* Aging term for a process that has waited w ticks; alpha is a kernel local. */
+#define AGING_NONE(w)  0
+#define AGING_FLOAT(w) ((int)(alpha * (w)))
+
+#define KERNEL_NAME fcfs_kernel_log
+#define KERNEL_LOG 1
+#define KERNEL_FCFS
+#include "sched_kernel.h"
+
+#define KERNEL_NAME fcfs_kernel_quiet
+#define KERNEL_LOG 0
+#define KERNEL_FCFS
+#include "sched_kernel.h"
+
+#define KERNEL_NAME rr_kernel_log
+#define KERNEL_LOG 1
+#define KERNEL_RR
+#include "sched_kernel.h"
+
+#define KERNEL_NAME rr_kernel_quiet
+#define KERNEL_LOG 0
+#define KERNEL_RR
+#include "sched_kernel.h"
+
+#define KERNEL_NAME prio_none_kernel_log
+#define KERNEL_LOG 1
+#define KERNEL_AGING AGING_NONE
+#include "sched_kernel.h"
+
+#define KERNEL_NAME prio_none_kernel_quiet
+#define KERNEL_LOG 0
+#define KERNEL_AGING AGING_NONE
+#include "sched_kernel.h"
+
+#define KERNEL_NAME prio_float_kernel_log
+#define KERNEL_LOG 1
+#define KERNEL_AGING AGING_FLOAT
+#include "sched_kernel.h"
+
+#define KERNEL_NAME prio_float_kernel_quiet
+#define KERNEL_LOG 0
+#define KERNEL_AGING AGING_FLOAT
+#include "sched_kernel.h"
+
+/* Indexed by [log_ticks]. */
+static const SimKernel fcfs_kernels[2] = { fcfs_kernel_quiet, fcfs_kernel_log };
+static const SimKernel rr_kernels[2] = { rr_kernel_quiet, rr_kernel_log };
+
+/* Indexed by [alpha != 0][log_ticks]; alpha == 0 is plain preemptive priority. */
+static const SimKernel prio_kernels[2][2] = {
+    { prio_none_kernel_quiet, prio_none_kernel_log },
+    { prio_float_kernel_quiet, prio_float_kernel_log },
+};
+
+void run_fcfs(Process jobQueue[], const char* outfile, int log_ticks) {
     FILE* out = fopen(outfile, "w");
     fprintf(out, "Scheduling : FCFS\n==============================\n");
 
-    int time = 0, done = 0;
-    ready_queue = NULL;
-    Process* running = NULL;
-
-    while (done < MAX_PROCESSES) {
-        for (int i = 0; i < MAX_PROCESSES; i++) {
-            if (jobQueue[i].arrival_time == time && jobQueue[i].state == NEW) {
-                jobQueue[i].state = READY;
-                enqueue(&jobQueue[i]);
-                fprintf(out, "<time %d> [new arrival] process %d\n", time, jobQueue[i].pid);
-            }
-        }
-
-        if (!running && ready_queue) {
-            running = dequeue();
-            running->state = RUNNING;
-            if (!running->started) {
-                running->start_time = time;
-                running->response_time = time - running->arrival_time;
-                running->started = 1;
-            }
-        }
-
-        if (running) {
-            fprintf(out, "<time %d> process %d is running\n", time, running->pid);
-            running->remaining_time--;
-            if (running->remaining_time == 0) {
-                running->state = FINISHED;
-                running->finish_time = time + 1;
-                running->turnaround_time = running->finish_time - running->arrival_time;
-                running->waiting_time = running->turnaround_time - running->burst_time;
-                running = NULL;
-                done++;
-            }
-        } else {
-            fprintf(out, "<time %d> ---- system is idle ----\n", time);
-        }
-        time++;
-    }
+    KernelParams params = { 0 };
+    int time = fcfs_kernels[log_ticks](jobQueue, out, &params);
 
     fprintf(out, "<time %d> all processes finish\n", time);
     fprintf(out, "==============================\n");
@@ -150,59 +154,13 @@ void run_fcfs(Process jobQueue[], const char* outfile) {
     fclose(out);
 }
 
-void run_rr(Process jobQueue[], const char* outfile, int quantum) {
+void run_rr(Process jobQueue[], const char* outfile, int quantum, int log_ticks) {
     FILE* out = fopen(outfile, "w");
     fprintf(out, "Scheduling : Round Robin (Time Quantum = %d)\n==============================\n", quantum);
 
-    int time = 0, done = 0;
-    ready_queue = NULL;
-    Process* running = NULL;
-    int time_slice = 0;
-
-    while (done < MAX_PROCESSES) {
-        for (int i = 0; i < MAX_PROCESSES; i++) {
-            if (jobQueue[i].arrival_time == time && jobQueue[i].state == NEW) {
-                jobQueue[i].state = READY;
-                enqueue(&jobQueue[i]);
-                fprintf(out, "<time %d> [new arrival] process %d\n", time, jobQueue[i].pid);
-            }
-        }
-
-        if (running && (time_slice == quantum || running->remaining_time == 0)) {
-            if (running->remaining_time > 0) {
-                enqueue(running);
-                running->state = READY;
-            } else {
-                running->state = FINISHED;
-                running->finish_time = time;
-                running->turnaround_time = time - running->arrival_time;
-                running->waiting_time = running->turnaround_time - running->burst_time;
-                done++;
-            }
-            running = NULL;
-            time_slice = 0;
-        }
-
-        if (!running && ready_queue) {
-            running = dequeue();
-            running->state = RUNNING;
-            if (!running->started) {
-                running->start_time = time;
-                running->response_time = time - running->arrival_time;
-                running->started = 1;
-            }
-        }
-
-        if (running) {
-            fprintf(out, "<time %d> process %d is running\n", time, running->pid);
-            running->remaining_time--;
-            time_slice++;
-        } else {
-            fprintf(out, "<time %d> ---- system is idle ----\n", time);
-        }
-
-        time++;
-    }
+    KernelParams params = { 0 };
+    params.quantum = quantum;
+    int time = rr_kernels[log_ticks](jobQueue, out, &params);
 
     fprintf(out, "<time %d> all processes finish\n", time);
     fprintf(out, "==============================\n");
@@ -210,60 +168,13 @@ void run_rr(Process jobQueue[], const char* outfile, int quantum) {
     fclose(out);
 }
 
-void run_priority(Process jobQueue[], const char* outfile, float alpha) {
+void run_priority(Process jobQueue[], const char* outfile, float alpha, int log_ticks) {
     FILE* out = fopen(outfile, "w");
     fprintf(out, "Scheduling : Preemptive Priority with Aging (alpha = %.2f)\n==============================\n", alpha);
 
-    int time = 0, done = 0;
-    ready_queue = NULL;
-    Process* running = NULL;
-
-    while (done < MAX_PROCESSES) {
-        for (int i = 0; i < MAX_PROCESSES; i++) {
-            if (jobQueue[i].arrival_time == time && jobQueue[i].state == NEW) {
-                jobQueue[i].state = READY;
-                enqueue(&jobQueue[i]);
-                fprintf(out, "<time %d> [new arrival] process %d\n", time, jobQueue[i].pid);
-            }
-        }
-
-        if (ready_queue) {
-            Process* candidate = select_highest_priority(alpha, time);
-            if (!running || candidate->priority + (int)(alpha * (time - candidate->arrival_time)) >
-                            running->priority + (int)(alpha * (time - running->arrival_time))) {
-                if (running) {
-                    running->state = READY;
-                    enqueue(running);
-                }
-                running = candidate;
-                running->state = RUNNING;
-                if (!running->started) {
-                    running->start_time = time;
-                    running->response_time = time - running->arrival_time;
-                    running->started = 1;
-                }
-            } else {
-                enqueue(candidate);
-            }
-        }
-
-        if (running) {
-            fprintf(out, "<time %d> process %d is running\n", time, running->pid);
-            running->remaining_time--;
-            if (running->remaining_time == 0) {
-                running->state = FINISHED;
-                running->finish_time = time + 1;
-                running->turnaround_time = running->finish_time - running->arrival_time;
-                running->waiting_time = running->turnaround_time - running->burst_time;
-                running = NULL;
-                done++;
-            }
-        } else {
-            fprintf(out, "<time %d> ---- system is idle ----\n", time);
-        }
-
-        time++;
-    }
+    KernelParams params = { 0 };
+    params.alpha = alpha;
+    int time = prio_kernels[alpha != 0][log_ticks](jobQueue, out, &params);
 
     fprintf(out, "<time %d> all processes finish\n", time);
     fprintf(out, "==============================\n");
@@ -272,8 +183,8 @@ void run_priority(Process jobQueue[], const char* outfile, float alpha) {
 }
 
 int main(int argc, char* argv[]) {
-    if (argc != 5) {
-        printf("Usage: %s [input_file] [output_file] [RR_quantum] [PRIO_alpha]\n", argv[0]);
+    if (argc != 5 && argc != 6) {
+        printf("Usage: %s [input_file] [output_file] [RR_quantum] [PRIO_alpha] [log_ticks (0 = summary only)]\n", argv[0]);
         return 1;
     }
 
@@ -281,17 +192,22 @@ int main(int argc, char* argv[]) {
     const char* output_file = argv[2];
     int rr_quantum = atoi(argv[3]);
     float prio_alpha = atof(argv[4]);
+    int log_ticks = argc == 6 ? atoi(argv[5]) != 0 : 1;
 
-    Process jobQueue[MAX_PROCESSES];
+    static Process jobQueue[MAX_PROCESSES];
 
-    load_processes_from_file(input_file, jobQueue);
-    run_fcfs(jobQueue, "fcfs_output.txt");
+    /* Every slot takes part in the simulation, so a short file would never finish. */
+    if (load_processes_from_file(input_file, jobQueue) < MAX_PROCESSES) {
+        printf("%s: %d processes required\n", input_file, MAX_PROCESSES);
+        return 1;
+    }
+    run_fcfs(jobQueue, "fcfs_output.txt", log_ticks);
 
     load_processes_from_file(input_file, jobQueue);
-    run_rr(jobQueue, "rr_output.txt", rr_quantum);
+    run_rr(jobQueue, "rr_output.txt", rr_quantum, log_ticks);
 
     load_processes_from_file(input_file, jobQueue);
-    run_priority(jobQueue, "priority_output.txt", prio_alpha);
+    run_priority(jobQueue, "priority_output.txt", prio_alpha, log_ticks);
 
     return 0;
-}
\ No newline at end of file
+}
@@ -0,0 +1,26 @@
+#!/bin/sh
+# Before/after cycles per simulated tick on generated traces.
+#   bench/bench.sh [repeats]
+# "before" is the baseline Scheduler.c, which always logs; "after" is the
+# current tree with per-tick logging on and off.
+set -e
+. "$(dirname "$0")/common.sh"
+REPEATS=${1:-7}
+
+run_case() {   # name count max_arrival min_burst max_burst quantum alpha
+    "$WORK/gen_trace" "$2" "$3" "$4" "$5" 7 > "$WORK/trace.txt"
+    $CC $CFLAGS -DMAX_PROCESSES="$2" -DBASELINE -DSCHEDULER_SRC="\"$WORK/baseline.c\"" \
+        "$BENCH_DIR/tick_cycles.c" -o "$WORK/before"
+    $CC $CFLAGS -DMAX_PROCESSES="$2" -DSCHEDULER_SRC="\"$REPO_DIR/Scheduler.c\"" \
+        "$BENCH_DIR/tick_cycles.c" -o "$WORK/after"
+    echo "$1 (q=$6, alpha=$7)"
+    printf '  before          '; "$WORK/before" "$WORK/trace.txt" "$6" "$7" 1 "$REPEATS"
+    printf '  after, log on   '; "$WORK/after" "$WORK/trace.txt" "$6" "$7" 1 "$REPEATS"
+    printf '  after, log off  '; "$WORK/after" "$WORK/trace.txt" "$6" "$7" 0 "$REPEATS"
+}
+
+for alpha in 0 0.5; do
+    run_case "10 processes, bursts 20000-60000" 10 100 20000 60000 4 $alpha
+    run_case "200 processes, bursts 1000-5000" 200 10 1000 5000 4 $alpha
+    run_case "2000 processes, bursts 1-20" 2000 2000 1 20 4 $alpha
+done
@@ -0,0 +1,16 @@
+# Shared by bench.sh and check.sh: builds gen_trace and extracts the
+# pre-kernel Scheduler.c (BASE, default: parent of the first user-026
+# commit) with MAX_PROCESSES made overridable.
+
+BENCH_DIR=$(cd "$(dirname "$0")" && pwd)
+REPO_DIR=$(dirname "$BENCH_DIR")
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+CC=${CC:-gcc}
+CFLAGS=${CFLAGS:--O2 -w}
+BASE=${BASE:-$(git -C "$REPO_DIR" log --format=%H --grep='^\[user-026\]' | tail -n 1)^}
+
+$CC $CFLAGS "$BENCH_DIR/gen_trace.c" -o "$WORK/gen_trace"
+git -C "$REPO_DIR" show "$BASE:Scheduler.c" |
+    sed 's/^#define MAX_PROCESSES 10$/#ifndef MAX_PROCESSES\n#define MAX_PROCESSES 10\n#endif/' > "$WORK/baseline.c"
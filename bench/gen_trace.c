@@ -0,0 +1,39 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * Writes a random Scheduler.c input trace to stdout:
+ *   gen_trace count max_arrival min_burst max_burst [seed]
+ * Uses its own xorshift generator so a seed gives the same trace everywhere.
+ */
+
+static unsigned int state;
+
+int next_rand(int lo, int hi) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return lo + (int)(state % (unsigned int)(hi - lo + 1));
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 5 && argc != 6) {
+        printf("Usage: %s [count] [max_arrival] [min_burst] [max_burst] [seed]\n", argv[0]);
+        return 1;
+    }
+
+    int count = atoi(argv[1]);
+    int max_arrival = atoi(argv[2]);
+    int min_burst = atoi(argv[3]);
+    int max_burst = atoi(argv[4]);
+    state = argc == 6 ? (unsigned int)atoi(argv[5]) : 1;
+    if (state == 0) state = 1;
+
+    for (int i = 0; i < count; i++) {
+        int priority = next_rand(0, 50);
+        int arrival = next_rand(0, max_arrival);
+        int burst = next_rand(min_burst, max_burst);
+        printf("%d %d %d %d\n", i + 1, priority, arrival, burst);
+    }
+    return 0;
+}
@@ -0,0 +1,58 @@
+#include <x86intrin.h>
+
+/*
+ * Cycles per simulated tick for each policy in Scheduler.c (x86 only, rdtsc).
+ * Build with -DMAX_PROCESSES=<lines in the trace> and -DSCHEDULER_SRC=<file>;
+ * add -DBASELINE when SCHEDULER_SRC is the version without log_ticks.
+ *   tick_cycles [trace] [RR_quantum] [PRIO_alpha] [log_ticks] [repeats]
+ * Per-tick lines go to /dev/null; the best of the repeats is reported.
+ */
+
+#define main scheduler_main
+#include SCHEDULER_SRC
+#undef main
+
+#ifdef BASELINE
+#define LOG_ARG
+#else
+#define LOG_ARG , log_ticks
+#endif
+
+static Process jobs[MAX_PROCESSES];
+
+int last_finish(void) {
+    int time = 0;
+    for (int i = 0; i < MAX_PROCESSES; i++)
+        if (jobs[i].finish_time > time) time = jobs[i].finish_time;
+    return time;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 6) {
+        printf("Usage: %s [trace] [RR_quantum] [PRIO_alpha] [log_ticks] [repeats]\n", argv[0]);
+        return 1;
+    }
+
+    const char* trace = argv[1];
+    int quantum = atoi(argv[2]);
+    float alpha = atof(argv[3]);
+    int log_ticks = atoi(argv[4]) != 0;
+    int repeats = atoi(argv[5]);
+    (void)log_ticks;
+
+    double best[3] = { 0, 0, 0 };
+    for (int r = 0; r < repeats; r++) {
+        for (int policy = 0; policy < 3; policy++) {
+            load_processes_from_file(trace, jobs);
+            unsigned long long start = __rdtsc();
+            if (policy == 0) run_fcfs(jobs, "/dev/null" LOG_ARG);
+            else if (policy == 1) run_rr(jobs, "/dev/null", quantum LOG_ARG);
+            else run_priority(jobs, "/dev/null", alpha LOG_ARG);
+            double cycles = (double)(__rdtsc() - start) / last_finish();
+            if (r == 0 || cycles < best[policy]) best[policy] = cycles;
+        }
+    }
+
+    printf("fcfs %.0f  rr %.0f  priority %.0f  cycles/tick\n", best[0], best[1], best[2]);
+    return 0;
+}
@@ -0,0 +1,139 @@
+/*
+ * Tick-loop template for Scheduler.c (no include guard on purpose).
+ *
+ * Scheduler.c includes this file once per specialized kernel. Before each
+ * include define
+ *   KERNEL_NAME      name of the generated function
+ *   KERNEL_LOG       1 to print the per-tick lines, 0 to leave them out
+ * and exactly one policy:
+ *   KERNEL_FCFS      first come, first served
+ *   KERNEL_RR        round robin with the quantum from the params
+ *   KERNEL_AGING     one of the AGING_* macros, for preemptive priority
+ * The kernel returns the time at which all processes finish. Every macro
+ * above is #undef'd at the end so the next kernel can be generated.
+ */
+
+#if defined(KERNEL_FCFS) + defined(KERNEL_RR) + defined(KERNEL_AGING) != 1
+#error "sched_kernel.h: define exactly one of KERNEL_FCFS, KERNEL_RR, KERNEL_AGING"
+#endif
+
+static int KERNEL_NAME(Process jobQueue[], FILE* out, const KernelParams* params) {
+    const int quantum = params->quantum;
+    const float alpha = params->alpha;
+    (void)out; (void)quantum; (void)alpha;
+
+    int time = 0, done = 0;
+    ready_queue = NULL;
+    Process* running = NULL;
+#ifdef KERNEL_RR
+    int time_slice = 0;
+#endif
+
+    while (done < MAX_PROCESSES) {
+        for (int i = 0; i < MAX_PROCESSES; i++) {
+            if (jobQueue[i].arrival_time == time && jobQueue[i].state == NEW) {
+                jobQueue[i].state = READY;
+                enqueue(&jobQueue[i]);
+                if (KERNEL_LOG)
+                    fprintf(out, "<time %d> [new arrival] process %d\n", time, jobQueue[i].pid);
+            }
+        }
+
+#ifdef KERNEL_RR
+        if (running && (time_slice == quantum || running->remaining_time == 0)) {
+            if (running->remaining_time > 0) {
+                enqueue(running);
+                running->state = READY;
+            } else {
+                running->state = FINISHED;
+                running->finish_time = time;
+                running->turnaround_time = time - running->arrival_time;
+                running->waiting_time = running->turnaround_time - running->burst_time;
+                done++;
+            }
+            running = NULL;
+            time_slice = 0;
+        }
+#endif
+
+#ifdef KERNEL_AGING
+        if (ready_queue) {
+            /* Same pick as select_highest_priority used to make: first process with the
+               highest effective priority, unlinked from the ready queue. */
+            Process* prev = NULL, *curr = ready_queue, *max_prev = NULL, *max = NULL;
+            int max_effective_priority = -1;
+
+            while (curr) {
+                int effective_priority = curr->priority + KERNEL_AGING(time - curr->arrival_time);
+                if (!max || effective_priority > max_effective_priority) {
+                    max = curr;
+                    max_prev = prev;
+                    max_effective_priority = effective_priority;
+                }
+                prev = curr;
+                curr = curr->next;
+            }
+            if (max_prev) max_prev->next = max->next;
+            else ready_queue = max->next;
+            max->next = NULL;
+
+            if (!running || max_effective_priority >
+                            running->priority + KERNEL_AGING(time - running->arrival_time)) {
+                if (running) {
+                    running->state = READY;
+                    enqueue(running);
+                }
+                running = max;
+                running->state = RUNNING;
+                if (!running->started) {
+                    running->start_time = time;
+                    running->response_time = time - running->arrival_time;
+                    running->started = 1;
+                }
+            } else {
+                enqueue(max);
+            }
+        }
+#else
+        if (!running && ready_queue) {
+            running = dequeue();
+            running->state = RUNNING;
+            if (!running->started) {
+                running->start_time = time;
+                running->response_time = time - running->arrival_time;
+                running->started = 1;
+            }
+        }
+#endif
+
+        if (running) {
+            if (KERNEL_LOG)
+                fprintf(out, "<time %d> process %d is running\n", time, running->pid);
+            running->remaining_time--;
+#ifdef KERNEL_RR
+            time_slice++;
+#else
+            if (running->remaining_time == 0) {
+                running->state = FINISHED;
+                running->finish_time = time + 1;
+                running->turnaround_time = running->finish_time - running->arrival_time;
+                running->waiting_time = running->turnaround_time - running->burst_time;
+                running = NULL;
+                done++;
+            }
+#endif
+        } else if (KERNEL_LOG) {
+            fprintf(out, "<time %d> ---- system is idle ----\n", time);
+        }
+
+        time++;
+    }
+
+    return time;
+}
+
+#undef KERNEL_NAME
+#undef KERNEL_LOG
+#undef KERNEL_FCFS
+#undef KERNEL_RR
+#undef KERNEL_AGING